@@ -1,29 +1,90 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 #include <mysqlx/xdevapi.h>
 
 using namespace mysqlx;
 
 // --- 設定您的 MySQL 連線資訊 ---
 const std::string MYSQL_HOST = "localhost";
+const int MYSQL_PORT = 33060;
 const std::string MYSQL_USER = "your_user";      // <-- 請填寫您的 MySQL 使用者名稱
 const std::string MYSQL_PASSWORD = "your_password";  // <-- 請填寫您的 MySQL 密碼
 const std::string DB_SCHEMA = "warehouse_db";
 
+// 要填入資料的資料表結構
+enum class TargetSchema {
+    Demo,          // 本程式的 item_codes / inventory
+    Registration   // warehouse_registration 的 item_definitions / inventory / item_locations
+};
+
+// 載入執行緒與批次大小的上限: 每個執行緒各佔一條 X Protocol 連線 (伺服器預設上限 100)，
+// 而單一多列 INSERT 須小於 mysqlx_max_allowed_packet
+const unsigned MAX_LOADER_THREADS = 64;
+const std::size_t MAX_BATCH_ROWS = 100000;
+
+// 測試資料產生器的參數 (皆可由命令列覆寫)
+struct GeneratorConfig {
+    std::size_t item_count = 1000;
+    int max_locations_per_item = 8;
+    double zipf_exponent = 1.2;      // 每個物品的位置數量服從 Zipf 分佈
+    std::uint64_t seed = 42;
+    unsigned loader_threads = 4;
+    std::size_t batch_rows = 1000;   // 每個多列 INSERT 的筆數
+    TargetSchema schema = TargetSchema::Demo;
+    std::string database = DB_SCHEMA;
+    bool show_help = false;
+};
+
+// 由 (seed, ordinal) 完全決定的單一物品資料，由載入執行緒在寫入時才產生
+struct ItemSpec {
+    std::uint64_t ordinal;   // 產生順序，用來推導該物品位置資料的亂數種子
+    std::string item_code;
+    std::string item_name;
+    std::string description;
+    int location_count;
+};
+
 // 函數原型
-void setup_database(Session& sql);
-void insert_sample_data(Schema& db);
+GeneratorConfig parse_arguments(int argc, char* argv[]);
+void print_usage(const char* program);
+void setup_database(Session& sql, const GeneratorConfig& config);
+void generate_sample_data(Session& sql, const GeneratorConfig& config);
+void print_summary(Session& sql, const GeneratorConfig& config);
 void query_and_print_inventory(Session& sql);
 
-int main() {
+int main(int argc, char* argv[]) {
+    GeneratorConfig config;
+    try {
+        config = parse_arguments(argc, argv);
+    } catch (const std::invalid_argument& ex) {
+        std::cerr << "ERROR: " << ex.what() << std::endl;
+        print_usage(argv[0]);
+        return 1;
+    }
+    if (config.show_help) {
+        print_usage(argv[0]);
+        return 0;
+    }
+
     try {
         std::cout << "Connecting to MySQL server at " << MYSQL_HOST << "..." << std::endl;
-        Session sql(MYSQL_HOST, 33060, MYSQL_USER, MYSQL_PASSWORD);
+        Session sql(MYSQL_HOST, MYSQL_PORT, MYSQL_USER, MYSQL_PASSWORD);
         std::cout << "Connection successful!" << std::endl;
 
-        setup_database(sql);
-        Schema db = sql.getSchema(DB_SCHEMA);
-        insert_sample_data(db);
-        query_and_print_inventory(sql);
+        setup_database(sql, config);
+        generate_sample_data(sql, config);
+        print_summary(sql, config);
 
     } catch (const mysqlx::Error &err) {
         std::cerr << "ERROR: " << err << std::endl;
@@ -39,59 +100,606 @@ int main() {
     return 0;
 }
 
-void setup_database(Session& sql) {
+// --- 命令列參數 ---
+
+void print_usage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --items N           number of SKUs to generate (default 1000)\n"
+              << "  --max-locations N   upper bound of locations per SKU (default 8)\n"
+              << "  --zipf S            Zipf exponent of the locations-per-SKU distribution (default 1.2)\n"
+              << "  --seed N            random seed; the same seed always yields the same data (default 42)\n"
+              << "  --threads N         parallel loader threads, at most 64 (default 4)\n"
+              << "  --batch N           rows per multi-row INSERT, at most 100000 (default 1000)\n"
+              << "  --schema NAME       demo | registration (default demo)\n"
+              << "  --database NAME     target database (default " << DB_SCHEMA << ")\n"
+              << "  --help              show this message" << std::endl;
+}
+
+// 將數值參數轉換為無號整數。std::stoull 會略過前導空白並把 "-1" 轉成極大的正數，
+// 因此要求第一個字元必須是數字
+unsigned long long parse_unsigned(const std::string& arg, const std::string& value) {
+    try {
+        std::size_t parsed = 0;
+        if (!value.empty() && std::isdigit(static_cast<unsigned char>(value[0]))) {
+            unsigned long long number = std::stoull(value, &parsed);
+            if (parsed == value.size()) {
+                return number;
+            }
+        }
+    } catch (const std::logic_error&) {
+        // std::stoull 在格式錯誤或溢位時拋出 invalid_argument / out_of_range
+    }
+    throw std::invalid_argument("invalid value '" + value + "' for " + arg);
+}
+
+// 同樣要求第一個字元是數字，拒絕前導空白與正負號
+double parse_double(const std::string& arg, const std::string& value) {
+    try {
+        std::size_t parsed = 0;
+        if (!value.empty() && std::isdigit(static_cast<unsigned char>(value[0]))) {
+            double number = std::stod(value, &parsed);
+            if (parsed == value.size()) {
+                return number;
+            }
+        }
+    } catch (const std::logic_error&) {
+    }
+    throw std::invalid_argument("invalid value '" + value + "' for " + arg);
+}
+
+GeneratorConfig parse_arguments(int argc, char* argv[]) {
+    GeneratorConfig config;
+    unsigned long long max_locations = config.max_locations_per_item;
+    unsigned long long loader_threads = config.loader_threads;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            config.show_help = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("missing value for " + arg);
+        }
+        const std::string value = argv[++i];
+        if (arg == "--items") {
+            config.item_count = parse_unsigned(arg, value);
+        } else if (arg == "--max-locations") {
+            max_locations = parse_unsigned(arg, value);
+        } else if (arg == "--zipf") {
+            config.zipf_exponent = parse_double(arg, value);
+        } else if (arg == "--seed") {
+            config.seed = parse_unsigned(arg, value);
+        } else if (arg == "--threads") {
+            loader_threads = parse_unsigned(arg, value);
+        } else if (arg == "--batch") {
+            config.batch_rows = parse_unsigned(arg, value);
+        } else if (arg == "--schema") {
+            if (value == "demo") {
+                config.schema = TargetSchema::Demo;
+            } else if (value == "registration") {
+                config.schema = TargetSchema::Registration;
+            } else {
+                throw std::invalid_argument("unknown schema '" + value + "'");
+            }
+        } else if (arg == "--database") {
+            if (value.empty()) {
+                throw std::invalid_argument("--database must not be empty");
+            }
+            config.database = value;
+        } else {
+            throw std::invalid_argument("unknown option " + arg);
+        }
+    }
+
+    if (config.item_count == 0 || config.item_count > 9999999) {
+        throw std::invalid_argument("--items must be between 1 and 9999999");
+    }
+    if (max_locations < 1 || max_locations > 1000) {
+        throw std::invalid_argument("--max-locations must be between 1 and 1000");
+    }
+    if (!(config.zipf_exponent >= 0.0)) {
+        throw std::invalid_argument("--zipf must not be negative");
+    }
+    if (loader_threads < 1 || loader_threads > MAX_LOADER_THREADS) {
+        throw std::invalid_argument("--threads must be between 1 and " + std::to_string(MAX_LOADER_THREADS));
+    }
+    if (config.batch_rows < 1 || config.batch_rows > MAX_BATCH_ROWS) {
+        throw std::invalid_argument("--batch must be between 1 and " + std::to_string(MAX_BATCH_ROWS));
+    }
+    config.max_locations_per_item = static_cast<int>(max_locations);
+    config.loader_threads = static_cast<unsigned>(loader_threads);
+    return config;
+}
+
+// --- 資料表結構 ---
+
+// 將資料庫或資料表名稱包在反引號中並將其中的反引號加倍，讓 "wh-test" 等名稱可直接組進 SQL 字串
+std::string quote_identifier(const std::string& name) {
+    std::string quoted = "`";
+    for (char c : name) {
+        if (c == '`') quoted += '`';
+        quoted += c;
+    }
+    return quoted + "`";
+}
+
+struct TableLayout {
+    std::string name;
+    std::vector<std::string> columns;
+};
+
+// 依外鍵相依的反向順序 (子表在前) 列出資料表及其欄位
+std::vector<TableLayout> target_tables(TargetSchema schema) {
+    if (schema == TargetSchema::Registration) {
+        return {
+            { "item_locations", { "item_code", "location_code", "quantity_at_location" } },
+            { "inventory", { "item_code", "total_quantity" } },
+            { "item_definitions", { "item_code", "item_name" } },
+        };
+    }
+    return {
+        { "inventory", { "id", "item_code", "location", "quantity", "last_updated" } },
+        { "item_codes", { "item_code", "item_name", "description" } },
+    };
+}
+
+// 兩種結構都有欄位不同的 inventory 資料表，而 CREATE TABLE IF NOT EXISTS 會保留既有的資料表。
+// 在建立或清空任何資料表前確認既有資料表的欄位相符，避免在另一種結構的資料庫中建立資料表，
+// 或把其資料 TRUNCATE 掉後才在 INSERT 時失敗。尚不存在的資料表 (查無欄位) 稍後才會建立，故略過。
+void verify_table_columns(Session& sql, const GeneratorConfig& config) {
+    for (const TableLayout& table : target_tables(config.schema)) {
+        SqlResult result = sql.sql(
+            "SELECT COLUMN_NAME FROM information_schema.COLUMNS "
+            "WHERE TABLE_SCHEMA = ? AND TABLE_NAME = ?"
+        ).bind(config.database, table.name).execute();
+
+        std::vector<std::string> actual;
+        for (Row row : result.fetchAll()) {
+            actual.push_back(row[0].get<std::string>());
+        }
+        if (actual.empty()) continue;
+        std::vector<std::string> expected = table.columns;
+        std::sort(actual.begin(), actual.end());
+        std::sort(expected.begin(), expected.end());
+
+        if (actual != expected) {
+            std::string found;
+            for (const std::string& column : actual) {
+                found += (found.empty() ? "" : ", ") + column;
+            }
+            throw std::runtime_error(
+                "table '" + config.database + "." + table.name + "' has columns (" + found +
+                ") which do not match --schema " +
+                (config.schema == TargetSchema::Registration ? "registration" : "demo") +
+                "; no tables or data were modified. Use --database to choose another database.");
+        }
+    }
+}
+
+void setup_database(Session& sql, const GeneratorConfig& config) {
+    verify_table_columns(sql, config);
+
     std::cout << "Creating schema and tables if they don't exist..." << std::endl;
-    sql.sql("CREATE DATABASE IF NOT EXISTS " + DB_SCHEMA).execute();
-    sql.sql("USE " + DB_SCHEMA).execute();
-
-    sql.sql(R"(
-        CREATE TABLE IF NOT EXISTS item_codes (
-            item_code VARCHAR(50) PRIMARY KEY,
-            item_name VARCHAR(255) NOT NULL,
-            description TEXT
-        )
-    )").execute();
+    sql.sql("CREATE DATABASE IF NOT EXISTS " + quote_identifier(config.database)).execute();
+    sql.sql("USE " + quote_identifier(config.database)).execute();
 
-    sql.sql(R"(
-        CREATE TABLE IF NOT EXISTS inventory (
-            id INT AUTO_INCREMENT PRIMARY KEY,
-            item_code VARCHAR(50),
-            location VARCHAR(100) NOT NULL,
-            quantity INT NOT NULL,
-            last_updated TIMESTAMP DEFAULT CURRENT_TIMESTAMP ON UPDATE CURRENT_TIMESTAMP,
-            FOREIGN KEY (item_code) REFERENCES item_codes(item_code)
-        )
-    )").execute();
+    if (config.schema == TargetSchema::Registration) {
+        // 與 warehouse_registration 使用的結構相同 (見 README)
+        sql.sql(R"(
+            CREATE TABLE IF NOT EXISTS item_definitions (
+                item_code VARCHAR(50) PRIMARY KEY,
+                item_name VARCHAR(255) NOT NULL
+            )
+        )").execute();
+
+        sql.sql(R"(
+            CREATE TABLE IF NOT EXISTS inventory (
+                item_code VARCHAR(50) PRIMARY KEY,
+                total_quantity INT NOT NULL DEFAULT 0,
+                FOREIGN KEY (item_code) REFERENCES item_definitions(item_code)
+            )
+        )").execute();
+
+        sql.sql(R"(
+            CREATE TABLE IF NOT EXISTS item_locations (
+                item_code VARCHAR(50),
+                location_code VARCHAR(50),
+                quantity_at_location INT NOT NULL DEFAULT 0,
+                PRIMARY KEY (item_code, location_code),
+                FOREIGN KEY (item_code) REFERENCES item_definitions(item_code)
+            )
+        )").execute();
+    } else {
+        sql.sql(R"(
+            CREATE TABLE IF NOT EXISTS item_codes (
+                item_code VARCHAR(50) PRIMARY KEY,
+                item_name VARCHAR(255) NOT NULL,
+                description TEXT
+            )
+        )").execute();
+
+        sql.sql(R"(
+            CREATE TABLE IF NOT EXISTS inventory (
+                id INT AUTO_INCREMENT PRIMARY KEY,
+                item_code VARCHAR(50),
+                location VARCHAR(100) NOT NULL,
+                quantity INT NOT NULL,
+                last_updated TIMESTAMP DEFAULT CURRENT_TIMESTAMP ON UPDATE CURRENT_TIMESTAMP,
+                FOREIGN KEY (item_code) REFERENCES item_codes(item_code)
+            )
+        )").execute();
+    }
     std::cout << "Schema and tables are ready." << std::endl;
 }
 
-void insert_sample_data(Schema& db) {
-    std::cout << "Inserting sample data..." << std::endl;
-    Table item_codes_table = db.getTable("item_codes");
-    Table inventory_table = db.getTable("inventory");
+// --- 亂數與分佈 ---
+
+// SplitMix64: 輸出由演算法完全決定，不像 std::*_distribution 會因標準函式庫實作而不同，
+// 因此同一個 seed 在任何平台上都會產生相同的資料。
+class SplitMix64 {
+public:
+    explicit SplitMix64(std::uint64_t seed) : state_(seed) {}
+
+    std::uint64_t next() {
+        std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // [0, n) 的整數；n 遠小於 2^64，取餘數造成的偏差可忽略
+    std::uint64_t below(std::uint64_t n) { return next() % n; }
+
+    // [0, 1) 的浮點數
+    double unit() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+private:
+    std::uint64_t state_;
+};
+
+// 每個物品各自的亂數來源，結果與載入執行緒數量及執行順序無關
+enum class RandomStream : std::uint64_t { Item = 0, Locations = 1 };
+
+SplitMix64 stream_for(std::uint64_t seed, std::uint64_t ordinal, RandomStream stream) {
+    SplitMix64 mixer(seed);
+    return SplitMix64(mixer.next() ^ (ordinal * 2 + static_cast<std::uint64_t>(stream)));
+}
+
+// P(k) 正比於 1 / k^s, k = 1..max_value
+class ZipfDistribution {
+public:
+    ZipfDistribution(int max_value, double exponent) {
+        cdf_.reserve(max_value);
+        double sum = 0.0;
+        for (int k = 1; k <= max_value; ++k) {
+            sum += 1.0 / std::pow(static_cast<double>(k), exponent);
+            cdf_.push_back(sum);
+        }
+        for (double& c : cdf_) {
+            c /= sum;
+        }
+    }
+
+    int sample(SplitMix64& rng) const {
+        auto it = std::upper_bound(cdf_.begin(), cdf_.end(), rng.unit());
+        std::size_t index = std::min<std::size_t>(it - cdf_.begin(), cdf_.size() - 1);
+        return static_cast<int>(index) + 1;
+    }
+
+    double mean() const {
+        double mean = 0.0, previous = 0.0;
+        for (std::size_t i = 0; i < cdf_.size(); ++i) {
+            mean += (i + 1) * (cdf_[i] - previous);
+            previous = cdf_[i];
+        }
+        return mean;
+    }
+
+private:
+    std::vector<double> cdf_;
+};
+
+// --- 物品與位置的命名規則 ---
+
+struct ProductLine {
+    const char* tag;    // 編碼中的系列代號，例如 "I7"
+    const char* name;   // 名稱中的品牌與系列，例如 "Intel Core i7"
+};
+
+struct ProductFamily {
+    const char* prefix;   // 編碼前綴，例如 "CPU"
+    std::vector<ProductLine> lines;
+    std::vector<const char*> model_suffixes;
+    std::vector<const char*> specs;
+    const char* category;
+};
+
+const std::vector<ProductFamily> PRODUCT_FAMILIES = {
+    { "CPU", { {"I5", "Intel Core i5"}, {"I7", "Intel Core i7"}, {"R5", "AMD Ryzen 5"}, {"R7", "AMD Ryzen 7"} },
+      { "", "K", "F", "X" }, { "6-Core", "8-Core", "12-Core", "16-Core" }, "Desktop Processor" },
+    { "GPU", { {"RTX", "NVIDIA GeForce RTX"}, {"RX", "AMD Radeon RX"}, {"ARC", "Intel Arc"} },
+      { "", " Ti", " XT", " SUPER" }, { "8GB GDDR6", "12GB GDDR6X", "16GB GDDR6", "24GB GDDR6X" }, "Graphics Card" },
+    { "RAM", { {"DDR4", "Kingston Fury DDR4"}, {"DDR5", "Corsair Vengeance DDR5"}, {"DDR5", "G.Skill Trident Z5"} },
+      { "" }, { "2x8GB", "2x16GB", "2x32GB", "4x16GB" }, "Memory Kit" },
+    { "SSD", { {"NVME", "Samsung NVMe"}, {"NVME", "WD Black NVMe"}, {"SATA", "Crucial SATA"} },
+      { "", " Pro", " Plus" }, { "500GB", "1TB", "2TB", "4TB" }, "Solid State Drive" },
+    { "PSU", { {"GLD", "Seasonic Focus Gold"}, {"PLT", "Corsair Platinum"} },
+      { "" }, { "650W", "750W", "850W", "1000W" }, "Power Supply" },
+};
+
+// 位置編碼 "A07-R32-L4": 區 (A-T) - 走道 (01-40) 與貨架 (01-60) - 層 (1-6)
+// 各欄位固定寬度，因此位置索引的大小順序與編碼的字典順序一致。
+const int LOCATION_ZONES = 20;
+const int LOCATION_AISLES = 40;
+const int LOCATION_RACKS = 60;
+const int LOCATION_LEVELS = 6;
+const int LOCATION_SPACE = LOCATION_ZONES * LOCATION_AISLES * LOCATION_RACKS * LOCATION_LEVELS;
+
+std::string location_code(int index) {
+    int level = index % LOCATION_LEVELS;
+    index /= LOCATION_LEVELS;
+    int rack = index % LOCATION_RACKS;
+    index /= LOCATION_RACKS;
+    int aisle = index % LOCATION_AISLES;
+    int zone = index / LOCATION_AISLES;
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%c%02d-R%02d-L%d", 'A' + zone, aisle + 1, rack + 1, level + 1);
+    return buffer;
+}
+
+// 物品編碼的前段，例如 "CPU-I7-"，其後接固定寬度的流水號
+std::string code_label(const ProductFamily& family, const ProductLine& line) {
+    return std::string(family.prefix) + "-" + line.tag + "-";
+}
 
-    // 清空舊資料 (新版 API 正確語法)
-    item_codes_table.remove().execute();
-    inventory_table.remove().execute();
+// 排序用的精簡鍵。系列代號不含 '-'，任兩個編碼前段都不會互為前綴，
+// 因此依 (前段排名, 流水號) 排序即等同依 item_code 的字典順序排序。
+struct ItemKey {
+    std::uint32_t label_rank;
+    std::uint32_t ordinal;
+};
 
-    item_codes_table.insert("item_code", "item_name", "description")
-        .values("CPU-I7-12700K", "Intel Core i7-12700K", "12th Gen Intel Processor")
-        .values("GPU-RTX-3080", "NVIDIA GeForce RTX 3080", "10GB GDDR6X Graphics Card")
-        .values("RAM-DDR5-32G", "Corsair Vengeance DDR5 32GB", "2x16GB, 5200MHz")
-        .execute();
+// 依字典順序為每個 (產品類別, 系列) 的編碼前段編號；前段相同的系列共用同一個排名
+std::vector<std::vector<std::uint32_t>> code_label_ranks() {
+    std::vector<std::string> labels;
+    for (const ProductFamily& family : PRODUCT_FAMILIES) {
+        for (const ProductLine& line : family.lines) {
+            labels.push_back(code_label(family, line));
+        }
+    }
+    std::sort(labels.begin(), labels.end());
+    labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
 
-    inventory_table.insert("item_code", "location", "quantity")
-        .values("CPU-I7-12700K", "Shelf A, Row 1", 50)
-        .values("GPU-RTX-3080", "Shelf B, Row 3", 25)
-        .values("RAM-DDR5-32G", "Shelf A, Row 2", 100)
-        .execute();
+    std::vector<std::vector<std::uint32_t>> ranks;
+    for (const ProductFamily& family : PRODUCT_FAMILIES) {
+        ranks.emplace_back();
+        for (const ProductLine& line : family.lines) {
+            auto it = std::lower_bound(labels.begin(), labels.end(), code_label(family, line));
+            ranks.back().push_back(static_cast<std::uint32_t>(it - labels.begin()));
+        }
+    }
+    return ranks;
+}
+
+// 只抽出決定編碼前段的前兩個亂數，抽樣順序須與 make_item 一致
+ItemKey make_item_key(std::uint64_t seed, std::uint64_t ordinal,
+                      const std::vector<std::vector<std::uint32_t>>& label_ranks) {
+    SplitMix64 rng = stream_for(seed, ordinal, RandomStream::Item);
+    std::size_t family = rng.below(PRODUCT_FAMILIES.size());
+    std::size_t line = rng.below(PRODUCT_FAMILIES[family].lines.size());
+    return { label_ranks[family][line], static_cast<std::uint32_t>(ordinal) };
+}
 
-    std::cout << "Sample data inserted." << std::endl;
+ItemSpec make_item(std::uint64_t seed, std::uint64_t ordinal, const ZipfDistribution& locations_per_item) {
+    SplitMix64 rng = stream_for(seed, ordinal, RandomStream::Item);
+    const ProductFamily& family = PRODUCT_FAMILIES[rng.below(PRODUCT_FAMILIES.size())];
+    const ProductLine& line = family.lines[rng.below(family.lines.size())];
+    const char* suffix = family.model_suffixes[rng.below(family.model_suffixes.size())];
+    const char* spec = family.specs[rng.below(family.specs.size())];
+    int model = 1000 + static_cast<int>(rng.below(9000));
+
+    char serial[16];
+    std::snprintf(serial, sizeof(serial), "%07llu", static_cast<unsigned long long>(ordinal + 1));
+
+    ItemSpec item;
+    item.ordinal = ordinal;
+    item.item_code = code_label(family, line) + serial;
+    item.item_name = std::string(line.name) + " " + std::to_string(model) + suffix;
+    item.description = std::string(spec) + " " + family.category;
+    item.location_count = locations_per_item.sample(rng);
+    return item;
+}
+
+// 為物品挑選 location_count 個不重複的位置，依位置編碼排序
+std::vector<int> pick_locations(SplitMix64& rng, int location_count) {
+    std::vector<int> picked;
+    picked.reserve(location_count);
+    while (static_cast<int>(picked.size()) < location_count) {
+        int candidate = static_cast<int>(rng.below(LOCATION_SPACE));
+        if (std::find(picked.begin(), picked.end(), candidate) == picked.end()) {
+            picked.push_back(candidate);
+        }
+    }
+    std::sort(picked.begin(), picked.end());
+    return picked;
+}
+
+// --- 批次載入 ---
+
+// 累積至 batch_rows 筆後，以單一多列 INSERT 送出。
+// 指定 parent 時會先送出父表尚未寫入的資料，確保子表資料寫入時其參照的父表資料已存在。
+class BatchedInsert {
+public:
+    BatchedInsert(std::function<TableInsert()> make_insert, std::size_t batch_rows,
+                  BatchedInsert* parent = nullptr)
+        : make_insert_(std::move(make_insert)), batch_rows_(batch_rows), parent_(parent) {
+        pending_.reserve(std::min<std::size_t>(batch_rows, 4096));
+    }
+
+    void add(Row row) {
+        pending_.push_back(std::move(row));
+        if (pending_.size() >= batch_rows_) {
+            flush();
+        }
+    }
+
+    void flush() {
+        if (pending_.empty()) return;
+        if (parent_) parent_->flush();
+        make_insert_().rows(pending_).execute();
+        pending_.clear();
+    }
+
+private:
+    std::function<TableInsert()> make_insert_;
+    std::size_t batch_rows_;
+    BatchedInsert* parent_;
+    std::vector<Row> pending_;
+};
+
+// 單一載入執行緒: 使用自己的 Session，依編碼順序寫入 [begin, end) 範圍內的物品
+std::uint64_t load_items(const GeneratorConfig& config, const ZipfDistribution& locations_per_item,
+                         const std::vector<ItemKey>& keys, std::size_t begin, std::size_t end) {
+    Session session(MYSQL_HOST, MYSQL_PORT, MYSQL_USER, MYSQL_PASSWORD);
+    session.sql("USE " + quote_identifier(config.database)).execute();
+    // 父表的批次總是先於子表送出，外鍵不會被違反；關閉檢查只是省去每筆子表資料對父表的查詢
+    session.sql("SET SESSION foreign_key_checks = 0").execute();
+    Schema db = session.getSchema(config.database);
+
+    std::uint64_t rows = 0;
+    if (config.schema == TargetSchema::Registration) {
+        Table definitions = db.getTable("item_definitions");
+        Table inventory = db.getTable("inventory");
+        Table locations = db.getTable("item_locations");
+        BatchedInsert definition_rows([&] { return definitions.insert("item_code", "item_name"); }, config.batch_rows);
+        BatchedInsert inventory_rows([&] {
+            return inventory.insert("item_code", "total_quantity");
+        }, config.batch_rows, &definition_rows);
+        BatchedInsert location_rows([&] {
+            return locations.insert("item_code", "location_code", "quantity_at_location");
+        }, config.batch_rows, &definition_rows);
+
+        for (std::size_t i = begin; i < end; ++i) {
+            ItemSpec item = make_item(config.seed, keys[i].ordinal, locations_per_item);
+            SplitMix64 rng = stream_for(config.seed, item.ordinal, RandomStream::Locations);
+            definition_rows.add(Row(item.item_code, item.item_name));
+            int total_quantity = 0;
+            for (int location : pick_locations(rng, item.location_count)) {
+                int quantity = 1 + static_cast<int>(rng.below(500));
+                total_quantity += quantity;
+                location_rows.add(Row(item.item_code, location_code(location), quantity));
+            }
+            inventory_rows.add(Row(item.item_code, total_quantity));
+            rows += 2 + item.location_count;
+        }
+        definition_rows.flush();
+        inventory_rows.flush();
+        location_rows.flush();
+    } else {
+        Table item_codes = db.getTable("item_codes");
+        Table inventory = db.getTable("inventory");
+        BatchedInsert item_rows([&] {
+            return item_codes.insert("item_code", "item_name", "description");
+        }, config.batch_rows);
+        BatchedInsert inventory_rows([&] {
+            return inventory.insert("item_code", "location", "quantity");
+        }, config.batch_rows, &item_rows);
+
+        for (std::size_t i = begin; i < end; ++i) {
+            ItemSpec item = make_item(config.seed, keys[i].ordinal, locations_per_item);
+            SplitMix64 rng = stream_for(config.seed, item.ordinal, RandomStream::Locations);
+            item_rows.add(Row(item.item_code, item.item_name, item.description));
+            for (int location : pick_locations(rng, item.location_count)) {
+                inventory_rows.add(Row(item.item_code, location_code(location), 1 + static_cast<int>(rng.below(500))));
+            }
+            rows += 1 + item.location_count;
+        }
+        item_rows.flush();
+        inventory_rows.flush();
+    }
+    return rows;
+}
+
+void generate_sample_data(Session& sql, const GeneratorConfig& config) {
+    const int max_locations = std::min(config.max_locations_per_item, LOCATION_SPACE);
+    ZipfDistribution locations_per_item(max_locations, config.zipf_exponent);
+
+    std::cout << "Generating " << config.item_count << " items (seed " << config.seed
+              << ", locations per item: Zipf s=" << config.zipf_exponent << " over 1.." << max_locations
+              << ", mean " << locations_per_item.mean() << ")..." << std::endl;
+
+    // 只保留每個物品 8 bytes 的排序鍵；完整資料由各載入執行緒依 ordinal 重新產生。
+    // 依主鍵排序後切成連續區段交給各執行緒，使每個執行緒都以遞增順序寫入 B-tree
+    const std::vector<std::vector<std::uint32_t>> label_ranks = code_label_ranks();
+    std::vector<ItemKey> keys;
+    keys.reserve(config.item_count);
+    for (std::size_t i = 0; i < config.item_count; ++i) {
+        keys.push_back(make_item_key(config.seed, i, label_ranks));
+    }
+    std::sort(keys.begin(), keys.end(), [](const ItemKey& a, const ItemKey& b) {
+        return a.label_rank != b.label_rank ? a.label_rank < b.label_rank : a.ordinal < b.ordinal;
+    });
+
+    // 清空舊資料；TRUNCATE 比逐列 DELETE 快得多，但被外鍵參照的資料表須暫停外鍵檢查
+    sql.sql("SET SESSION foreign_key_checks = 0").execute();
+    for (const TableLayout& table : target_tables(config.schema)) {
+        sql.sql("TRUNCATE TABLE " + quote_identifier(table.name)).execute();
+    }
+    sql.sql("SET SESSION foreign_key_checks = 1").execute();
+
+    const unsigned thread_count = static_cast<unsigned>(
+        std::min<std::size_t>(config.loader_threads, keys.size()));
+    std::cout << "Loading with " << thread_count << " threads, " << config.batch_rows
+              << " rows per INSERT..." << std::endl;
+
+    auto started = std::chrono::steady_clock::now();
+    std::vector<std::thread> loaders;
+    std::vector<std::uint64_t> loaded_rows(thread_count, 0);
+    std::vector<std::exception_ptr> errors(thread_count);
+    for (unsigned t = 0; t < thread_count; ++t) {
+        std::size_t begin = keys.size() * t / thread_count;
+        std::size_t end = keys.size() * (t + 1) / thread_count;
+        loaders.emplace_back([&, t, begin, end] {
+            try {
+                loaded_rows[t] = load_items(config, locations_per_item, keys, begin, end);
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    for (std::thread& loader : loaders) {
+        loader.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+
+    std::uint64_t total_rows = 0;
+    for (std::uint64_t rows : loaded_rows) {
+        total_rows += rows;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    std::cout << "Sample data inserted: " << total_rows << " rows in " << seconds << " s ("
+              << static_cast<std::uint64_t>(total_rows / std::max(seconds, 1e-3)) << " rows/s)." << std::endl;
+}
+
+// --- 結果輸出 ---
+
+void print_summary(Session& sql, const GeneratorConfig& config) {
+    std::cout << "\n--- Row Counts ---" << std::endl;
+    for (const TableLayout& table : target_tables(config.schema)) {
+        Row row = sql.sql("SELECT COUNT(*) FROM " + quote_identifier(table.name)).execute().fetchOne();
+        std::cout << table.name << ": " << row[0] << std::endl;
+    }
+    if (config.schema == TargetSchema::Demo) {
+        query_and_print_inventory(sql);
+    }
 }
 
 void query_and_print_inventory(Session& sql) {
-    std::cout << "\n--- Current Warehouse Inventory ---" << std::endl;
-    
+    std::cout << "\n--- Current Warehouse Inventory (first 20 rows) ---" << std::endl;
+
     SqlResult result = sql.sql(R"(
         SELECT
             inv.id,
@@ -105,7 +713,8 @@ void query_and_print_inventory(Session& sql) {
         JOIN
             item_codes AS ic ON inv.item_code = ic.item_code
         ORDER BY
-            inv.location
+            inv.id
+        LIMIT 20
     )").execute();
 
     for (Row row : result.fetchAll()) {
@@ -118,4 +727,3 @@ void query_and_print_inventory(Session& sql) {
     }
     std::cout << "--- End of Report ---" << std::endl;
 }
-